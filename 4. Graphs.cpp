@@ -116,9 +116,192 @@ void map_bfs(int start_r, int start_c, vector<vector<int>>& grid) {
   }
 } 
 
+// Splits [0, count) into num_threads chunks and runs f(lo, hi, thread_id) on each
+template <typename F>
+void parallel_chunks(size_t count, int num_threads, F f) {
+  if (num_threads <= 1 || count < 2) {
+    f(size_t(0), count, 0);
+    return;
+  }
+  vector<thread> workers;
+  size_t chunk = (count + num_threads - 1) / num_threads;
+  for (int t = 0; t < num_threads; t++) {
+    size_t lo = t * chunk;
+    size_t hi = min(count, lo + chunk);
+    if (lo >= hi) break;
+    workers.emplace_back(f, lo, hi, t);
+  }
+  for (thread& w: workers) w.join();
+}
+
+// Stamp trick for "visited" marks that get reused over and over: a mark is
+// set if marks[x] == stamp, so moving to the next stamp clears them all in
+// O(1). Only once every 4 billion stamps do we wrap and really clear
+void next_stamp(vector<uint32_t>& marks, uint32_t& stamp) {
+  if (++stamp == 0) {
+    fill(marks.begin(), marks.end(), 0);
+    stamp = 1;
+  }
+}
+
 /*
   Union Find (disjoing sets)
+  Keeps track of which set each element is in. Every set is a tree, and
+  the root is the representative. find(x) walks up to the root,
+  unite(a, b) points one root at the other.
+  Two tricks make it basically O(1) (inverse ackermann) per op:
+    union by size: hang the smaller tree under the bigger one
+    path halving: while walking up, point each node at its grandparent
+  Look for: connected components, cycle detection in undirected graph,
+            Kruskal's, "are these two things in the same group"
 */
+class UnionFind {
+private:
+  vector<uint32_t> parent;
+  vector<uint32_t> size;
+
+public:
+  UnionFind(uint32_t n): parent(n), size(n, 1) {
+    for (uint32_t i = 0; i < n; i++) parent[i] = i;
+  }
+
+  uint32_t find(uint32_t x) {
+    while (parent[x] != x) {
+      // path halving, skip a level every step
+      parent[x] = parent[parent[x]];
+      x = parent[x];
+    }
+    return x;
+  }
+
+  // return false if already in same set
+  bool unite(uint32_t a, uint32_t b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) return false;
+    if (size[a] < size[b]) swap(a, b);
+    parent[b] = a;
+    size[a] += size[b];
+    return true;
+  }
+
+  bool connected(uint32_t a, uint32_t b) {
+    return find(a) == find(b);
+  }
+};
+
+/*
+  Concurrent Union Find (Jayanti-Tarjan style)
+  Same idea but many threads can unite/find at once without locks.
+  parent is an array of atomic uint32 (4 bytes per node).
+  Can't do union by size anymore (size and parent can't be updated together),
+  so every node gets a fixed random rank (a shuffled permutation) and the
+  root with the lower rank goes under the higher one. Random linking order
+  is what gives the O(log n) expected depth, so callers don't have to
+  shuffle their ids.
+  Linking is a CAS on the root's parent, if it fails someone else moved
+  that root so we just find again and retry.
+  Path halving is also a CAS, if it fails it doesn't matter, some other
+  thread already shortened the path.
+*/
+class ConcurrentUnionFind {
+private:
+  vector<atomic<uint32_t>> parent;
+  // random permutation of [0, n), never changes so no atomics needed
+  vector<uint32_t> rank;
+
+public:
+  ConcurrentUnionFind(uint32_t n, uint64_t seed = 0x5eed): parent(n), rank(n) {
+    for (uint32_t i = 0; i < n; i++) {
+      parent[i].store(i, memory_order_relaxed);
+      rank[i] = i;
+    }
+    mt19937_64 rng(seed);
+    shuffle(rank.begin(), rank.end(), rng);
+  }
+
+  uint32_t find(uint32_t x) {
+    while (true) {
+      uint32_t p = parent[x].load(memory_order_acquire);
+      if (p == x) return x;
+      uint32_t gp = parent[p].load(memory_order_acquire);
+      // try to halve, fine if we lose the race
+      if (p != gp) parent[x].compare_exchange_weak(p, gp, memory_order_release, memory_order_relaxed);
+      x = gp;
+    }
+  }
+
+  bool unite(uint32_t a, uint32_t b) {
+    while (true) {
+      a = find(a);
+      b = find(b);
+      if (a == b) return false;
+      // always link lower rank under higher so no cycles can form
+      if (rank[a] > rank[b]) swap(a, b);
+      uint32_t expected = a;
+      if (parent[a].compare_exchange_strong(expected, b, memory_order_acq_rel)) return true;
+      // a stopped being a root, go again
+    }
+  }
+
+  bool connected(uint32_t a, uint32_t b) {
+    while (true) {
+      a = find(a);
+      b = find(b);
+      if (a == b) return true;
+      // a might have been linked while we looked at b, only trust
+      // the answer if a is still a root
+      if (parent[a].load(memory_order_acquire) == a) return false;
+    }
+  }
+
+  // batch versions, split the edges between threads
+  // returns number of unites that actually merged two sets
+  size_t unite_many(const vector<pair<uint32_t, uint32_t>>& edges, int num_threads) {
+    atomic<size_t> merged{0};
+    parallel_chunks(edges.size(), num_threads, [&](size_t lo, size_t hi, int) {
+      size_t local = 0;
+      for (size_t i = lo; i < hi; i++) local += unite(edges[i].first, edges[i].second);
+      merged += local;
+    });
+    return merged;
+  }
+
+  vector<uint32_t> find_many(const vector<uint32_t>& nodes, int num_threads) {
+    vector<uint32_t> res(nodes.size());
+    parallel_chunks(nodes.size(), num_threads, [&](size_t lo, size_t hi, int) {
+      for (size_t i = lo; i < hi; i++) res[i] = find(nodes[i]);
+    });
+    return res;
+  }
+};
+
+// Quick benchmark: random edges, time unite_many for 1..max_threads threads
+// should see close to linear speedup until memory bandwidth runs out
+void benchUnionFind(uint32_t n, size_t num_edges, int max_threads) {
+  mt19937 rng(42);
+  uniform_int_distribution<uint32_t> pick(0, n - 1);
+  vector<pair<uint32_t, uint32_t>> edges(num_edges);
+  for (auto& e: edges) e = {pick(rng), pick(rng)};
+
+  UnionFind seq(n);
+  auto start = chrono::steady_clock::now();
+  for (auto& e: edges) seq.unite(e.first, e.second);
+  double base = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  cout << "sequential: " << base << "s" << endl;
+
+  // powers of two, plus max_threads itself even if it isn't one
+  vector<int> counts;
+  for (int t = 1; t < max_threads; t *= 2) counts.push_back(t);
+  counts.push_back(max(max_threads, 1));
+  for (int t: counts) {
+    ConcurrentUnionFind uf(n);
+    start = chrono::steady_clock::now();
+    uf.unite_many(edges, t);
+    double secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << t << " threads: " << secs << "s (" << base / secs << "x vs sequential)" << endl;
+  }
+}
 
 /*
   Topological Sort
@@ -127,56 +310,210 @@ void map_bfs(int start_r, int start_c, vector<vector<int>>& grid) {
   Ie every parent of a node come before it
 */
 
-// Topological sort built on dfs, we use stack so we add node after children
-// and we use visited set to not repeat. Let's say labelled [0, numN)
-// this implementation will also detect cycles
-vector<int> getTopo(int numN, vector<vector<int>>& adj_list) {
-  stack<int> s;
-  vector<bool> visited(numN, false);
-  for (int i = 0; i < numN; i++) {
-    if (!visited[i]) {
-      vector<bool> path(numN, false);
-      if(!topo(i, adj_list, path, visited, s)) return {};
+/*
+  Kahn's algorithm, no recursion so long chains can't blow the stack.
+  Count in-degree of every node, every node with in-degree 0 can go first.
+  Take one, "remove" its edges by decrementing its children's in-degree,
+  any child that hits 0 is ready. O(V + E).
+  If we run out of ready nodes before placing all of them the rest have
+  a cycle. Doing it round by round (all currently ready nodes at once)
+  gives levels: nothing in a level depends on anything else in that level,
+  so for scheduling a whole level can run in parallel.
+  Nodes labelled [0, numN)
+*/
+struct TopoResult {
+  vector<int> order;           // empty if there is a cycle
+  vector<vector<int>> levels;
+  vector<int> cycle;           // one cycle in edge order, empty if DAG
+};
+
+TopoResult topoSort(int numN, const vector<vector<int>>& adj_list) {
+  TopoResult res;
+  vector<int> in_degree(numN, 0);
+  for (int u = 0; u < numN; u++) {
+    for (int v: adj_list[u]) in_degree[v]++;
+  }
+  vector<int> ready;
+  for (int u = 0; u < numN; u++) {
+    if (in_degree[u] == 0) ready.push_back(u);
+  }
+  res.order.reserve(numN);
+  while (!ready.empty()) {
+    vector<int> next;
+    for (int u: ready) {
+      res.order.push_back(u);
+      for (int v: adj_list[u]) {
+        if (--in_degree[v] == 0) next.push_back(v);
+      }
     }
+    res.levels.push_back(move(ready));
+    ready = move(next);
   }
-  vector<int> res;
-  while (s.size() > 0) {
-    res.push_back(s.top());
-    s.pop();
+  if ((int)res.order.size() == numN) return res;
+
+  // Cycle: every leftover node still has an in-edge from another leftover
+  // node, so walking backwards along those must eventually repeat
+  vector<int> parent(numN, -1);
+  int start = -1;
+  for (int u = 0; u < numN; u++) {
+    if (in_degree[u] == 0) continue;
+    for (int v: adj_list[u]) {
+      if (in_degree[v] > 0) parent[v] = u;
+    }
+    start = u;
+  }
+  vector<bool> seen(numN, false);
+  while (!seen[start]) {
+    seen[start] = true;
+    start = parent[start];
   }
+  for (int v = start; ; v = parent[v]) {
+    res.cycle.push_back(v);
+    if (parent[v] == start) break;
+  }
+  reverse(res.cycle.begin(), res.cycle.end());
+  res.order.clear();
+  res.levels.clear();
   return res;
 }
 
-// return false if a cycle was detected
-bool topo(int node, vector<vector<int>>& adj_list, vector<bool>& path, vector<bool>& visited, stack<int>& s) {
-  if (path[node]) return false;
-  path[node] = true;
-  for (int next: adj_list[node]) {
-    if (!visited[next] && !topo(next, adj_list, path, visited, s)) return false;
-  }
-  visited[node] = true;
-  s.push(node);
-  return true;
+// Returns {} if a cycle was detected
+vector<int> getTopo(int numN, const vector<vector<int>>& adj_list) {
+  return topoSort(numN, adj_list).order;
 }
 
+/*
+  Incremental topological order (Pearce-Kelly)
+  Keep an order while edges get added instead of re-sorting every time.
+  ord[node] = position. Adding u -> v with ord[u] < ord[v] is free.
+  Otherwise only nodes with positions between ord[v] and ord[u] can be
+  affected: F = nodes reachable from v (staying at or before ord[u]),
+  B = nodes that reach u (staying at or after ord[v]). If F hits u the
+  edge makes a cycle. Else take the positions F and B used, and hand them
+  out again, B first then F, each keeping their relative order.
+  Cost is proportional to the affected region, not the whole graph.
+*/
+class IncrementalTopo {
+private:
+  vector<vector<int>> out, in;
+  vector<int> ord;        // ord[node] = position
+  vector<int> node_at;    // node_at[position] = node
+  // visited marks reused between calls via a stamp, no O(V) clear
+  vector<uint32_t> mark;
+  vector<int> parent;
+  uint32_t stamp = 0;
+
+  // iterative dfs from start along dir, only through positions in [lo, hi]
+  // returns true if it reached target
+  bool search(int start, const vector<vector<int>>& dir, int lo, int hi, int target, vector<int>& found) {
+    vector<int> st = {start};
+    mark[start] = stamp;
+    parent[start] = -1;
+    while (st.size() > 0) {
+      int node = st.back();
+      st.pop_back();
+      found.push_back(node);
+      for (int next: dir[node]) {
+        if (mark[next] == stamp || ord[next] < lo || ord[next] > hi) continue;
+        mark[next] = stamp;
+        parent[next] = node;
+        if (next == target) return true;
+        st.push_back(next);
+      }
+    }
+    return false;
+  }
+
+public:
+  vector<int> cycle;   // set by addEdge when it refuses an edge
+
+  IncrementalTopo(int numN = 0) {
+    for (int i = 0; i < numN; i++) addNode();
+  }
+
+  int addNode() {
+    int id = ord.size();
+    out.emplace_back();
+    in.emplace_back();
+    ord.push_back(id);
+    node_at.push_back(id);
+    mark.push_back(0);
+    parent.push_back(-1);
+    return id;
+  }
+
+  // Returns false (and fills cycle) if u -> v would make a cycle,
+  // the edge is not added in that case
+  bool addEdge(int u, int v) {
+    cycle.clear();
+    if (u == v) {
+      cycle = {u};
+      return false;
+    }
+    int lo = ord[v], hi = ord[u];
+    if (lo > hi) {
+      out[u].push_back(v);
+      in[v].push_back(u);
+      return true;
+    }
+    next_stamp(mark, stamp);
+    vector<int> forward, backward;
+    if (search(v, out, lo, hi, u, forward)) {
+      // path v -> ... -> u, plus the new edge closes it
+      for (int x = u; x != -1; x = parent[x]) cycle.push_back(x);
+      reverse(cycle.begin(), cycle.end());
+      return false;
+    }
+    // F and B can't overlap, otherwise F would have reached u
+    search(u, in, lo, hi, -1, backward);
+
+    auto by_ord = [&](int a, int b) {return ord[a] < ord[b];};
+    sort(forward.begin(), forward.end(), by_ord);
+    sort(backward.begin(), backward.end(), by_ord);
+    vector<int> slots;
+    for (int x: backward) slots.push_back(ord[x]);
+    for (int x: forward) slots.push_back(ord[x]);
+    sort(slots.begin(), slots.end());
+    int i = 0;
+    for (int x: backward) ord[x] = slots[i++];
+    for (int x: forward) ord[x] = slots[i++];
+    for (int x: backward) node_at[ord[x]] = x;
+    for (int x: forward) node_at[ord[x]] = x;
+
+    out[u].push_back(v);
+    in[v].push_back(u);
+    return true;
+  }
+
+  int position(int node) const { return ord[node]; }
+
+  // current order, O(V) since it's a copy
+  vector<int> order() const { return node_at; }
+};
+
 // Dijkstra's
-int dijkstras(int src, int dst, int numNodes, vector<vector<pair<int, int>> adj_list) {
-  vector<int> dists(numNodes, INT_MAX);
+// adj_list[u] holds {weight, v}. Only works with non negative weights.
+// O((V + E) log V). Uses long long so dist + weight can't overflow, and
+// stops as soon as dst is popped since its distance can't improve after that
+long long dijkstras(int src, int dst, int numNodes, const vector<vector<pair<int, int>>>& adj_list) {
+  vector<long long> dists(numNodes, LLONG_MAX);
   dists[src] = 0;
   vector<bool> visited(numNodes, false);
-  auto comparator = [](pair<int, int>& p1, pair<int, int>& p2) {return p1.first > p2.first;};
-  priority_queue<pair<int, int>, vector<pair<int, int>>, decltype(comparator)> min_heap;
+  // comparator has to take const refs or priority_queue won't compile
+  auto comparator = [](const pair<long long, int>& p1, const pair<long long, int>& p2) {return p1.first > p2.first;};
+  priority_queue<pair<long long, int>, vector<pair<long long, int>>, decltype(comparator)> min_heap(comparator);
   min_heap.push({0, src});
   while (min_heap.size() > 0) {
-    int dist = min_heap.top().first;
-    int node =min_heap.top().second;
+    long long dist = min_heap.top().first;
+    int node = min_heap.top().second;
     min_heap.pop();
+    if (node == dst) return dist;
     if (visited[node]) continue;
     visited[node] = true;
-    for (pair<int, int>& next: adj_list[node]) {
+    for (const pair<int, int>& next: adj_list[node]) {
       int next_node = next.second;
       int edge_weight = next.first;
-      int new_dist = dist + edge_weight;
+      long long new_dist = dist + edge_weight;
       if (new_dist < dists[next_node]) {
         dists[next_node] = new_dist;
         min_heap.push({new_dist, next_node});
@@ -186,9 +523,850 @@ int dijkstras(int src, int dst, int numNodes, vector<vector<pair<int, int>> adj_
   return dists[dst];
 }
 
+/*
+  Radix Heap
+  Min heap for when keys are integers and popped keys never go down
+  (true for Dijkstra with non negative weights). Bucket i holds keys whose
+  highest differing bit from the last popped key is bit i - 1. Popping
+  only redistributes one bucket, each key moves at most 64 times total
+  so it's O(log C) amortized and way more cache friendly than a binary heap.
+*/
+class RadixHeap {
+private:
+  vector<pair<uint64_t, int>> buckets[65];
+  uint64_t last = 0;
+  size_t count = 0;
+
+  static int bucket_of(uint64_t x) {
+    return x == 0 ? 0 : 64 - __builtin_clzll(x);
+  }
+
+  // makes sure buckets[0] is non empty
+  void pull() {
+    if (!buckets[0].empty()) return;
+    int i = 1;
+    while (buckets[i].empty()) i++;
+    uint64_t new_last = buckets[i][0].first;
+    for (auto& item: buckets[i]) new_last = min(new_last, item.first);
+    last = new_last;
+    for (auto& item: buckets[i]) buckets[bucket_of(item.first ^ last)].push_back(item);
+    buckets[i].clear();
+  }
+
+public:
+  bool empty() const { return count == 0; }
+
+  void push(uint64_t key, int val) {
+    count++;
+    buckets[bucket_of(key ^ last)].push_back({key, val});
+  }
+
+  uint64_t top_key() {
+    pull();
+    return buckets[0].back().first;
+  }
+
+  pair<uint64_t, int> pop() {
+    pull();
+    count--;
+    pair<uint64_t, int> res = buckets[0].back();
+    buckets[0].pop_back();
+    return res;
+  }
+
+  // keeps the bucket memory around so the next query doesn't reallocate
+  void clear() {
+    for (auto& b: buckets) b.clear();
+    last = 0;
+    count = 0;
+  }
+};
+
+/*
+  Shortest path engine for answering lots of queries on the same graph.
+  Graph is stored as CSR (compressed sparse row): all edges in one array,
+  out_start[u]..out_start[u + 1] are the edges of u. Way faster than
+  vector<vector<>> to iterate. We also keep the reversed graph for
+  bidirectional search.
+  All scratch arrays are allocated once. Instead of resetting dist to INF
+  before every query (O(V)), each query bumps a stamp and dist[v] is only
+  valid if stamp_of[v] == stamp. So a query only pays for what it touches.
+  Weights must be non negative.
+*/
+class ShortestPaths {
+public:
+  static constexpr int64_t INF = numeric_limits<int64_t>::max();
+
+  // one directed edge, weights are 64 bit so reweighted graphs (Johnson) fit
+  struct Arc {
+    int from, to;
+    int64_t weight;
+  };
+
+private:
+  int n;
+  // forward and reverse graph in CSR form
+  vector<int> out_start, out_to;
+  vector<int64_t> out_w;
+  vector<int> in_start, in_to;
+  vector<int64_t> in_w;
+
+  // per query scratch, index 0 is forward search and 1 is backward search
+  vector<int64_t> dist[2];
+  vector<int> pred[2];
+  // one array for both sides, side s of node v is at s * n + v
+  vector<uint32_t> stamp_of;
+  uint32_t stamp = 0;
+  RadixHeap heap[2];
 
-// Bellman-Ford
+  // remembered so lastPath() works after either kind of query
+  int last_src = -1, last_dst = -1, meet = -1;
 
-// Kruskal's
+  // reversed = true builds the graph with every arc flipped
+  static void build_csr(int n, const vector<Arc>& arcs, bool reversed, vector<int>& start, vector<int>& to, vector<int64_t>& w) {
+    start.assign(n + 1, 0);
+    for (const Arc& a: arcs) start[(reversed ? a.to : a.from) + 1]++;
+    for (int i = 0; i < n; i++) start[i + 1] += start[i];
+    to.resize(arcs.size());
+    w.resize(arcs.size());
+    vector<int> pos(start.begin(), start.end() - 1);
+    for (const Arc& a: arcs) {
+      int u = reversed ? a.to : a.from;
+      to[pos[u]] = reversed ? a.from : a.to;
+      w[pos[u]++] = a.weight;
+    }
+  }
+
+  static vector<Arc> arcs_of(const vector<vector<pair<int, int>>>& adj_list) {
+    vector<Arc> arcs;
+    for (int u = 0; u < (int)adj_list.size(); u++) {
+      for (auto& e: adj_list[u]) arcs.push_back({u, e.second, e.first});
+    }
+    return arcs;
+  }
+
+  void new_query() {
+    next_stamp(stamp_of, stamp);
+    heap[0].clear();
+    heap[1].clear();
+  }
+
+  int64_t get(int side, int v) const {
+    return stamp_of[side * n + v] == stamp ? dist[side][v] : INF;
+  }
+
+  void set(int side, int v, int64_t d, int p) {
+    stamp_of[side * n + v] = stamp;
+    dist[side][v] = d;
+    pred[side][v] = p;
+  }
+
+public:
+  // adj_list[u] holds {weight, v} like dijkstras above
+  ShortestPaths(const vector<vector<pair<int, int>>>& adj_list): ShortestPaths(adj_list.size(), arcs_of(adj_list)) {}
 
-// Prim's
+  ShortestPaths(int n, const vector<Arc>& arcs): n(n) {
+    build_csr(n, arcs, false, out_start, out_to, out_w);
+    build_csr(n, arcs, true, in_start, in_to, in_w);
+    for (int s = 0; s < 2; s++) {
+      dist[s].resize(n);
+      pred[s].resize(n);
+    }
+    stamp_of.assign(2 * n, 0);
+  }
+
+  // Dijkstra with radix heap, stops once dst is popped. Returns INF if unreachable
+  int64_t query(int src, int dst) {
+    new_query();
+    last_src = src;
+    last_dst = dst;
+    meet = -1;
+    set(0, src, 0, -1);
+    heap[0].push(0, src);
+    while (!heap[0].empty()) {
+      auto [d, u] = heap[0].pop();
+      // stale entry, we already found something shorter
+      if ((int64_t)d != get(0, u)) continue;
+      if (u == dst) {
+        meet = dst;
+        return d;
+      }
+      for (int i = out_start[u]; i < out_start[u + 1]; i++) {
+        int v = out_to[i];
+        int64_t nd = d + out_w[i];
+        if (nd < get(0, v)) {
+          set(0, v, nd, u);
+          heap[0].push(nd, v);
+        }
+      }
+    }
+    return INF;
+  }
+
+  /*
+    Bidirectional Dijkstra: search forward from src and backward from dst
+    (on reversed graph) at the same time, always growing the side with the
+    smaller top. Keep best = min over edges (u, v) of df[u] + w + db[v].
+    Once top_f + top_b >= best nothing left can beat it so stop.
+    Touches roughly 2 * (r/2)^2 instead of r^2 area on road-like graphs.
+  */
+  int64_t bidirectional(int src, int dst) {
+    new_query();
+    last_src = src;
+    last_dst = dst;
+    meet = -1;
+    set(0, src, 0, -1);
+    set(1, dst, 0, -1);
+    heap[0].push(0, src);
+    heap[1].push(0, dst);
+    int64_t best = src == dst ? 0 : INF;
+    if (src == dst) meet = src;
+    while (!heap[0].empty() && !heap[1].empty()) {
+      int64_t top_f = heap[0].top_key();
+      int64_t top_b = heap[1].top_key();
+      if (best != INF && top_f + top_b >= best) break;
+      int side = top_f <= top_b ? 0 : 1;
+      auto [d, u] = heap[side].pop();
+      if ((int64_t)d != get(side, u)) continue;
+      const vector<int>& start = side == 0 ? out_start : in_start;
+      const vector<int>& to = side == 0 ? out_to : in_to;
+      const vector<int64_t>& w = side == 0 ? out_w : in_w;
+      for (int i = start[u]; i < start[u + 1]; i++) {
+        int v = to[i];
+        int64_t nd = d + w[i];
+        if (nd < get(side, v)) {
+          set(side, v, nd, u);
+          heap[side].push(nd, v);
+        }
+        // use v's best dist on this side, that's what pred will walk back along
+        int64_t here = get(side, v), other = get(1 - side, v);
+        if (other != INF && here + other < best) {
+          best = here + other;
+          meet = v;
+        }
+      }
+    }
+    return best;
+  }
+
+  // Plain Dijkstra to every node (dst = -1 never matches so it never stops early)
+  vector<int64_t> allFrom(int src) {
+    query(src, -1);
+    vector<int64_t> res(n);
+    for (int v = 0; v < n; v++) res[v] = get(0, v);
+    return res;
+  }
+
+  // Path of the last query/bidirectional call, empty if dst unreachable
+  // walks pred from meet back to src, then pred on the backward side to dst
+  vector<int> lastPath() const {
+    if (meet == -1) return {};
+    vector<int> path;
+    for (int v = meet; v != -1; v = pred[0][v]) path.push_back(v);
+    reverse(path.begin(), path.end());
+    // backward side only has entries this query if we did bidirectional
+    if (stamp_of[n + meet] == stamp) {
+      for (int v = pred[1][meet]; v != -1; v = pred[1][v]) path.push_back(v);
+    }
+    return path;
+  }
+
+  /*
+    Delta-stepping, for distances from src to every node using many threads.
+    Buckets of width delta: bucket i has nodes with dist in [i*delta, (i+1)*delta).
+    Take the lowest bucket, relax its light edges (w <= delta) in parallel,
+    which can put nodes back into the same bucket, repeat until it's empty.
+    Then relax heavy edges of everything that was in it once (they always
+    land in later buckets). delta = 1 is Dijkstra, delta = INF is Bellman-Ford,
+    something around max_weight / average_degree is usually good.
+    dist updates are atomic fetch-min with CAS.
+    Buckets live in a map keyed by bucket number and only exist while they
+    hold nodes, so memory depends on how many nodes are waiting, not on
+    max_dist / delta, and we jump straight to the next non empty bucket.
+  */
+  vector<int64_t> deltaStepping(int src, int64_t delta, int num_threads) {
+    // bucket = dist / delta, so delta < 1 makes no sense (and would divide by 0)
+    delta = max<int64_t>(delta, 1);
+    vector<atomic<int64_t>> d(n);
+    for (auto& x: d) x.store(INF, memory_order_relaxed);
+    d[src] = 0;
+    map<int64_t, vector<int>> buckets;
+    buckets[0].push_back(src);
+    // stamps for dedup, in_frontier per light round, in_settled per bucket
+    vector<uint32_t> in_frontier(n, 0), in_settled(n, 0);
+    uint32_t round = 0, bucket_no = 0;
+    vector<vector<int>> improved(max(num_threads, 1));
+
+    // relax the light (or heavy) edges out of frontier, each thread collects
+    // the nodes it lowered in improved[t], then we bucket them after the join
+    auto relax = [&](const vector<int>& frontier, bool light) {
+      parallel_chunks(frontier.size(), num_threads, [&](size_t lo, size_t hi, int t) {
+        for (size_t k = lo; k < hi; k++) {
+          int u = frontier[k];
+          int64_t du = d[u].load(memory_order_relaxed);
+          for (int i = out_start[u]; i < out_start[u + 1]; i++) {
+            if ((out_w[i] <= delta) != light) continue;
+            int v = out_to[i];
+            int64_t nd = du + out_w[i];
+            int64_t cur = d[v].load(memory_order_relaxed);
+            while (nd < cur) {
+              if (d[v].compare_exchange_weak(cur, nd, memory_order_relaxed)) {
+                improved[t].push_back(v);
+                break;
+              }
+            }
+          }
+        }
+      });
+      for (auto& list: improved) {
+        for (int v: list) {
+          buckets[d[v].load(memory_order_relaxed) / delta].push_back(v);
+        }
+        list.clear();
+      }
+    };
+
+    while (!buckets.empty()) {
+      // relaxing bucket i only ever adds to buckets >= i
+      int64_t i = buckets.begin()->first;
+      vector<int> settled;
+      next_stamp(in_settled, bucket_no);
+      while (buckets.count(i) > 0) {
+        vector<int> frontier;
+        swap(frontier, buckets[i]);
+        buckets.erase(i);
+        next_stamp(in_frontier, round);
+        // drop nodes whose dist moved since they were bucketed, and duplicates
+        size_t keep = 0;
+        for (int u: frontier) {
+          if (d[u].load(memory_order_relaxed) / delta != i || in_frontier[u] == round) continue;
+          in_frontier[u] = round;
+          frontier[keep++] = u;
+          if (in_settled[u] != bucket_no) {
+            in_settled[u] = bucket_no;
+            settled.push_back(u);
+          }
+        }
+        frontier.resize(keep);
+        relax(frontier, true);
+      }
+      relax(settled, false);
+    }
+
+    vector<int64_t> res(n);
+    for (int v = 0; v < n; v++) res[v] = d[v].load(memory_order_relaxed);
+    return res;
+  }
+};
+
+
+/*
+  Bellman-Ford
+  Works with negative weights. Relax every edge, V - 1 times. After pass k
+  dist is at least as good as the best path with k edges, and a shortest
+  path has at most V - 1 edges. If anything still improves on pass V there
+  is a negative cycle reachable from src. O(VE), but usually we stop way
+  earlier since a pass that changes nothing means we're done.
+  Edges are kept in one flat array, no adj list needed, and each pass is
+  split between threads. dist is atomic, updated with CAS min. Threads see
+  each other's updates mid pass, which only makes a pass converge faster,
+  never slower, so the V - 1 bound still holds.
+*/
+struct Edge {
+  int from, to, weight;
+};
+
+struct BellmanFordResult {
+  vector<int64_t> dist;          // INF if unreachable
+  vector<int> pred;              // -1 for src and unreachable
+  bool negative_cycle = false;
+  vector<int> cycle;             // vertices of one negative cycle, in order
+};
+
+const int64_t BF_INF = numeric_limits<int64_t>::max();
+
+// Sequential Bellman-Ford tracking pred, only used once we know there's a
+// negative cycle. A node still improving on pass V is on or hangs off the
+// cycle, walking pred V times from it is guaranteed to land on the cycle.
+// src == -1 means start from every node at once (dist 0 everywhere)
+vector<int> find_negative_cycle(int n, const vector<Edge>& edges, int src) {
+  vector<int64_t> dist(n, src == -1 ? 0 : BF_INF);
+  if (src != -1) dist[src] = 0;
+  vector<int> pred(n, -1);
+  int last = -1;
+  for (int pass = 0; pass < n; pass++) {
+    last = -1;
+    for (const Edge& e: edges) {
+      if (dist[e.from] == BF_INF) continue;
+      if (dist[e.from] + e.weight < dist[e.to]) {
+        dist[e.to] = dist[e.from] + e.weight;
+        pred[e.to] = e.from;
+        last = e.to;
+      }
+    }
+    if (last == -1) return {};
+  }
+  // n == 0 never runs a pass, so there's no node to walk back from
+  if (last == -1) return {};
+  for (int i = 0; i < n; i++) last = pred[last];
+  vector<int> cycle;
+  for (int v = last; ; v = pred[v]) {
+    cycle.push_back(v);
+    if (v == last && cycle.size() > 1) break;
+  }
+  cycle.pop_back();
+  reverse(cycle.begin(), cycle.end());
+  return cycle;
+}
+
+BellmanFordResult bellmanFord(int n, const vector<Edge>& edges, int src, int num_threads) {
+  vector<atomic<int64_t>> d(n);
+  for (auto& x: d) x.store(src == -1 ? 0 : BF_INF, memory_order_relaxed);
+  if (src != -1) d[src] = 0;
+
+  BellmanFordResult res;
+  // only set by passes that actually ran, an empty graph has no cycle
+  bool changed = false;
+  for (int pass = 0; pass < n && (pass == 0 || changed); pass++) {
+    atomic<bool> any{false};
+    parallel_chunks(edges.size(), num_threads, [&](size_t lo, size_t hi, int) {
+      bool local = false;
+      for (size_t i = lo; i < hi; i++) {
+        const Edge& e = edges[i];
+        int64_t du = d[e.from].load(memory_order_relaxed);
+        if (du == BF_INF) continue;
+        int64_t nd = du + e.weight;
+        int64_t cur = d[e.to].load(memory_order_relaxed);
+        while (nd < cur) {
+          if (d[e.to].compare_exchange_weak(cur, nd, memory_order_relaxed)) {
+            local = true;
+            break;
+          }
+        }
+      }
+      if (local) any = true;
+    });
+    changed = any;
+  }
+
+  // still changing after V passes
+  if (changed) {
+    res.negative_cycle = true;
+    res.cycle = find_negative_cycle(n, edges, src);
+    return res;
+  }
+
+  res.dist.resize(n);
+  for (int v = 0; v < n; v++) res.dist[v] = d[v].load(memory_order_relaxed);
+  // pred can't be updated together with the atomic dist, so rebuild it:
+  // BFS over tight edges (dist[u] + w == dist[v]) from the sources.
+  // BFS so zero weight cycles can't make pred loop
+  res.pred.assign(n, -1);
+  vector<vector<int>> tight(n);
+  for (const Edge& e: edges) {
+    if (res.dist[e.from] != BF_INF && res.dist[e.from] + e.weight == res.dist[e.to]) tight[e.from].push_back(e.to);
+  }
+  vector<bool> visited(n, false);
+  queue<int> q;
+  for (int v = 0; v < n; v++) {
+    // with src == -1 the roots are the nodes whose best path is the 0 edge
+    // straight from the virtual source
+    if (v == src || (src == -1 && res.dist[v] == 0)) {
+      visited[v] = true;
+      q.push(v);
+    }
+  }
+  while (q.size() > 0) {
+    int u = q.front();
+    q.pop();
+    for (int v: tight[u]) {
+      if (!visited[v]) {
+        visited[v] = true;
+        res.pred[v] = u;
+        q.push(v);
+      }
+    }
+  }
+  return res;
+}
+
+/*
+  SPFA (Shortest Path Faster Algorithm)
+  Bellman-Ford but only relax edges out of nodes whose dist just changed,
+  keep those in a queue. Same O(VE) worst case but usually close to O(E).
+  If a shortest path ever uses V edges there's a negative cycle.
+*/
+BellmanFordResult spfa(int n, const vector<vector<pair<int, int>>>& adj_list, int src) {
+  BellmanFordResult res;
+  res.dist.assign(n, BF_INF);
+  res.pred.assign(n, -1);
+  // number of edges on the current path to each node
+  vector<int> len(n, 0);
+  vector<bool> in_queue(n, false);
+  queue<int> q;
+  res.dist[src] = 0;
+  q.push(src);
+  in_queue[src] = true;
+  while (q.size() > 0) {
+    int u = q.front();
+    q.pop();
+    in_queue[u] = false;
+    for (const pair<int, int>& next: adj_list[u]) {
+      int v = next.second;
+      int64_t nd = res.dist[u] + next.first;
+      if (nd >= res.dist[v]) continue;
+      res.dist[v] = nd;
+      res.pred[v] = u;
+      len[v] = len[u] + 1;
+      if (len[v] >= n) {
+        // walk back n steps to make sure we are on the cycle
+        int x = v;
+        for (int i = 0; i < n; i++) x = res.pred[x];
+        for (int y = x; ; y = res.pred[y]) {
+          res.cycle.push_back(y);
+          if (res.pred[y] == x) break;
+        }
+        reverse(res.cycle.begin(), res.cycle.end());
+        res.negative_cycle = true;
+        return res;
+      }
+      if (!in_queue[v]) {
+        in_queue[v] = true;
+        q.push(v);
+      }
+    }
+  }
+  return res;
+}
+
+/*
+  Johnson's reweighting
+  Lets us use the fast Dijkstra engine on graphs with negative edges.
+  Run Bellman-Ford once from a virtual node with 0 weight edges to everyone,
+  call that h. Then w'(u, v) = w + h[u] - h[v] is never negative and every
+  path from s to t changes by exactly h[s] - h[t], so shortest paths stay
+  the same. All pairs is V Dijkstras instead of V Bellman-Fords.
+  w' can be as big as (V - 1) * |min w|, way past an int, so the reweighted
+  graph goes into ShortestPaths with 64 bit weights.
+  If there is a negative cycle there are no shortest paths, every query
+  returns INF / empty.
+*/
+class Johnson {
+private:
+  vector<int64_t> h;
+  unique_ptr<ShortestPaths> sp;
+
+public:
+  bool negative_cycle = false;
+
+  Johnson(int n, const vector<Edge>& edges, int num_threads) {
+    BellmanFordResult bf = bellmanFord(n, edges, -1, num_threads);
+    if (bf.negative_cycle) {
+      negative_cycle = true;
+      return;
+    }
+    h = bf.dist;
+    vector<ShortestPaths::Arc> arcs;
+    arcs.reserve(edges.size());
+    for (const Edge& e: edges) arcs.push_back({e.from, e.to, e.weight + h[e.from] - h[e.to]});
+    sp = make_unique<ShortestPaths>(n, arcs);
+  }
+
+  // ShortestPaths::INF if unreachable
+  int64_t query(int src, int dst) {
+    if (negative_cycle) return ShortestPaths::INF;
+    int64_t d = sp->query(src, dst);
+    if (d == ShortestPaths::INF) return d;
+    return d - h[src] + h[dst];
+  }
+
+  // same path in original graph, only the weights were changed
+  vector<int> lastPath() const {
+    if (negative_cycle) return {};
+    return sp->lastPath();
+  }
+
+  vector<int64_t> allFrom(int src) {
+    if (negative_cycle) return {};
+    vector<int64_t> res = sp->allFrom(src);
+    for (int v = 0; v < (int)res.size(); v++) {
+      if (res[v] != ShortestPaths::INF) res[v] += h[v] - h[src];
+    }
+    return res;
+  }
+};
+
+/*
+  Minimum Spanning Tree / Forest
+  Undirected weighted graph, pick edges with min total weight so everything
+  connected stays connected. If the graph isn't connected we get a forest.
+  All three below use the Edge struct from Bellman-Ford and return the
+  forest edges. Weights don't have to be unique, any MST has the same total.
+*/
+
+int64_t forestWeight(const vector<Edge>& forest) {
+  int64_t total = 0;
+  for (const Edge& e: forest) total += e.weight;
+  return total;
+}
+
+bool lighter(const Edge& a, const Edge& b) {
+  return a.weight < b.weight;
+}
+
+// Parallel merge sort: each thread sorts a chunk, then merge neighbours
+// in rounds (chunk pairs merge in parallel), log(threads) rounds
+void parallel_sort_edges(vector<Edge>& edges, int num_threads) {
+  if (num_threads <= 1 || edges.size() < 4096) {
+    sort(edges.begin(), edges.end(), lighter);
+    return;
+  }
+  size_t chunk = (edges.size() + num_threads - 1) / num_threads;
+  parallel_chunks(edges.size(), num_threads, [&](size_t lo, size_t hi, int) {
+    sort(edges.begin() + lo, edges.begin() + hi, lighter);
+  });
+  for (size_t width = chunk; width < edges.size(); width *= 2) {
+    size_t pairs = (edges.size() + 2 * width - 1) / (2 * width);
+    parallel_chunks(pairs, num_threads, [&](size_t lo, size_t hi, int) {
+      for (size_t p = lo; p < hi; p++) {
+        size_t start = p * 2 * width;
+        size_t mid = min(edges.size(), start + width);
+        size_t end = min(edges.size(), start + 2 * width);
+        inplace_merge(edges.begin() + start, edges.begin() + mid, edges.begin() + end, lighter);
+      }
+    });
+  }
+}
+
+/*
+  Kruskal's
+  Sort edges by weight, add each one unless it connects two nodes that are
+  already connected (union find). O(E log E), the sort dominates.
+  Filter-Kruskal: like quicksort, pick a pivot weight and split into light
+  and heavy edges. Do light first, then throw away every heavy edge that is
+  now inside one component before recursing on it. On big graphs most heavy
+  edges get filtered so we never pay to sort them.
+*/
+void filter_kruskal(vector<Edge>& edges, UnionFind& uf, vector<Edge>& forest, int num_threads, size_t base_size, mt19937& rng) {
+  if (edges.size() <= base_size) {
+    parallel_sort_edges(edges, num_threads);
+    for (const Edge& e: edges) {
+      if (uf.unite(e.from, e.to)) forest.push_back(e);
+    }
+    return;
+  }
+  int pivot = edges[rng() % edges.size()].weight;
+  auto mid = partition(edges.begin(), edges.end(), [pivot](const Edge& e) {return e.weight <= pivot;});
+  vector<Edge> heavy(mid, edges.end());
+  edges.erase(mid, edges.end());
+  // everything was <= pivot, splitting again won't help
+  if (heavy.empty()) {
+    filter_kruskal(edges, uf, forest, num_threads, edges.size(), rng);
+    return;
+  }
+  filter_kruskal(edges, uf, forest, num_threads, base_size, rng);
+  vector<Edge>().swap(edges);
+  heavy.erase(remove_if(heavy.begin(), heavy.end(), [&](const Edge& e) {return uf.connected(e.from, e.to);}), heavy.end());
+  filter_kruskal(heavy, uf, forest, num_threads, base_size, rng);
+}
+
+vector<Edge> kruskals(int n, vector<Edge> edges, int num_threads) {
+  UnionFind uf(n);
+  vector<Edge> forest;
+  mt19937 rng(12345);
+  // below ~a few edges per node just sorting everything is as good
+  filter_kruskal(edges, uf, forest, num_threads, max<size_t>(4 * (size_t)n, 1024), rng);
+  return forest;
+}
+
+/*
+  Prim's
+  Grow the tree from a node, always add the cheapest edge leaving the tree.
+  Like Dijkstra but the key is the edge weight not the path length.
+  Indexed heap: a binary heap that also knows where every node is in it, so
+  we can decrease a node's key in place instead of pushing duplicates.
+  Heap never holds more than V entries. O(E log V), good for dense graphs.
+*/
+class IndexedMinHeap {
+private:
+  vector<int> heap;       // node ids
+  vector<int> pos;        // pos[node] = index in heap, -1 if not in it
+  vector<int64_t> key;
+
+  void swap_at(int i, int j) {
+    swap(heap[i], heap[j]);
+    pos[heap[i]] = i;
+    pos[heap[j]] = j;
+  }
+
+  void up(int i) {
+    while (i > 0 && key[heap[(i - 1) / 2]] > key[heap[i]]) {
+      swap_at(i, (i - 1) / 2);
+      i = (i - 1) / 2;
+    }
+  }
+
+  void down(int i) {
+    while (true) {
+      int smallest = i;
+      int l = 2 * i + 1, r = 2 * i + 2;
+      if (l < (int)heap.size() && key[heap[l]] < key[heap[smallest]]) smallest = l;
+      if (r < (int)heap.size() && key[heap[r]] < key[heap[smallest]]) smallest = r;
+      if (smallest == i) return;
+      swap_at(i, smallest);
+      i = smallest;
+    }
+  }
+
+public:
+  IndexedMinHeap(int n): pos(n, -1), key(n) {}
+
+  bool empty() const { return heap.empty(); }
+
+  bool contains(int node) const { return pos[node] != -1; }
+
+  // insert, or lower the key if already in there
+  void push_or_decrease(int node, int64_t k) {
+    if (pos[node] == -1) {
+      pos[node] = heap.size();
+      heap.push_back(node);
+    } else if (k >= key[node]) {
+      return;
+    }
+    key[node] = k;
+    up(pos[node]);
+  }
+
+  int pop() {
+    int top = heap[0];
+    swap_at(0, heap.size() - 1);
+    heap.pop_back();
+    pos[top] = -1;
+    if (!heap.empty()) down(0);
+    return top;
+  }
+};
+
+vector<Edge> prims(int n, const vector<Edge>& edges) {
+  // adj_list[u] holds {weight, v}
+  vector<vector<pair<int, int>>> adj_list(n);
+  for (const Edge& e: edges) {
+    adj_list[e.from].push_back({e.weight, e.to});
+    adj_list[e.to].push_back({e.weight, e.from});
+  }
+  IndexedMinHeap heap(n);
+  vector<bool> in_tree(n, false);
+  // cheapest known edge into each node from the tree
+  vector<int> best_from(n, -1);
+  vector<int> best_weight(n);
+  vector<Edge> forest;
+  // restart from every node not reached yet to get a forest
+  for (int root = 0; root < n; root++) {
+    if (in_tree[root]) continue;
+    heap.push_or_decrease(root, 0);
+    while (!heap.empty()) {
+      int u = heap.pop();
+      in_tree[u] = true;
+      if (best_from[u] != -1) forest.push_back({best_from[u], u, best_weight[u]});
+      for (const pair<int, int>& next: adj_list[u]) {
+        int v = next.second;
+        if (in_tree[v]) continue;
+        if (best_from[v] == -1 || next.first < best_weight[v]) {
+          best_from[v] = u;
+          best_weight[v] = next.first;
+          heap.push_or_decrease(v, next.first);
+        }
+      }
+    }
+  }
+  return forest;
+}
+
+/*
+  Boruvka's
+  Every component picks its cheapest outgoing edge, add all of those at
+  once, repeat. Number of components at least halves each round so
+  O(log V) rounds of O(E) work, and each round is easy to do in parallel:
+  threads scan edge chunks and CAS-min the best edge for each component.
+  Ties must be broken the same way everywhere (by edge index here) or two
+  components could pick different equal edges and make a cycle.
+*/
+vector<Edge> boruvka(int n, const vector<Edge>& edges, int num_threads) {
+  ConcurrentUnionFind uf(n);
+  const uint64_t NONE = numeric_limits<uint64_t>::max();
+  // best[root] packs (weight, edge index) into one word so it's one CAS.
+  // weight ^ sign bit keeps negative weights ordered correctly as unsigned
+  vector<atomic<uint64_t>> best(n);
+  auto pack = [](int weight, uint32_t idx) {
+    return ((uint64_t)((uint32_t)weight ^ 0x80000000u) << 32) | idx;
+  };
+  auto cas_min = [](atomic<uint64_t>& slot, uint64_t val) {
+    uint64_t cur = slot.load(memory_order_relaxed);
+    while (val < cur && !slot.compare_exchange_weak(cur, val, memory_order_relaxed)) {}
+  };
+
+  vector<uint32_t> alive(edges.size());
+  for (uint32_t i = 0; i < edges.size(); i++) alive[i] = i;
+  vector<vector<Edge>> found(max(num_threads, 1));
+  vector<vector<uint32_t>> keep(max(num_threads, 1));
+  vector<Edge> forest;
+
+  while (!alive.empty()) {
+    parallel_chunks(n, num_threads, [&](size_t lo, size_t hi, int) {
+      for (size_t v = lo; v < hi; v++) best[v].store(NONE, memory_order_relaxed);
+    });
+    // find cheapest edge out of each component, drop edges inside one
+    parallel_chunks(alive.size(), num_threads, [&](size_t lo, size_t hi, int t) {
+      for (size_t k = lo; k < hi; k++) {
+        const Edge& e = edges[alive[k]];
+        uint32_t a = uf.find(e.from), b = uf.find(e.to);
+        if (a == b) continue;
+        keep[t].push_back(alive[k]);
+        uint64_t packed = pack(e.weight, alive[k]);
+        cas_min(best[a], packed);
+        cas_min(best[b], packed);
+      }
+    });
+    // link along the chosen edges, both sides may pick the same edge so
+    // only the unite that actually merges records it
+    parallel_chunks(n, num_threads, [&](size_t lo, size_t hi, int t) {
+      for (size_t v = lo; v < hi; v++) {
+        uint64_t b = best[v].load(memory_order_relaxed);
+        if (b == NONE) continue;
+        const Edge& e = edges[(uint32_t)b];
+        if (uf.unite(e.from, e.to)) found[t].push_back(e);
+      }
+    });
+    alive.clear();
+    for (int t = 0; t < (int)keep.size(); t++) {
+      alive.insert(alive.end(), keep[t].begin(), keep[t].end());
+      forest.insert(forest.end(), found[t].begin(), found[t].end());
+      keep[t].clear();
+      found[t].clear();
+    }
+  }
+  return forest;
+}
+
+// Benchmark: same random graph through all three, weights should match.
+// sparse ~ 4 edges per node, dense ~ n^2 / 8 edges
+void benchMST(int n, int num_threads) {
+  mt19937 rng(7);
+  for (size_t m: {(size_t)4 * n, (size_t)n * n / 8}) {
+    vector<Edge> edges(m);
+    for (Edge& e: edges) e = {int(rng() % n), int(rng() % n), int(rng() % 1000000)};
+    cout << "n = " << n << ", m = " << m << endl;
+
+    auto start = chrono::steady_clock::now();
+    int64_t w = forestWeight(kruskals(n, edges, num_threads));
+    cout << "  filter-kruskal: " << chrono::duration<double>(chrono::steady_clock::now() - start).count() << "s weight " << w << endl;
+
+    start = chrono::steady_clock::now();
+    w = forestWeight(prims(n, edges));
+    cout << "  prim: " << chrono::duration<double>(chrono::steady_clock::now() - start).count() << "s weight " << w << endl;
+
+    start = chrono::steady_clock::now();
+    w = forestWeight(boruvka(n, edges, num_threads));
+    cout << "  boruvka: " << chrono::duration<double>(chrono::steady_clock::now() - start).count() << "s weight " << w << endl;
+  }
+}
@@ -8,28 +8,29 @@
 // 1-Dimensional DP example, get nth fibonnaci number
 
 // Non DP recursive solution, O(2^n) because for each n, two calls
-int Fib(int n) {
+long long Fib(int n) {
   if (n == 1 || n == 2) return 1;
   return Fib(n - 1) + Fib(n - 2);
 }
 
 // memoization DP solution
-int DP_Fib(int n) {
-  // cache, can also use map
-  vector<int> memo(n, -1);
+// long long since Fib(47) already doesn't fit in an int
+long long DP_Fib(int n) {
+  // cache, can also use map. -1 works as "not computed" since fib is never negative
+  vector<long long> memo(n, -1);
   return memo_Fib(n, memo);
 }
 
 // Top down, memoization DP solution
 // O(n) time, O(n) space, since we do less recursive calls 
 // less because we cut subtree from call graph by caching
-int memo_Fib(int n, vector<int>& memo) {
+long long memo_Fib(int n, vector<long long>& memo) {
   // base case
   if (n == 1 || n == 2) return 1;
   // if result cached, return that
   if (memo[n-1] != -1) return memo[n-1];
   // otherwise calculate result
-  int res = memo_Fib(n-1, memo) + memo_Fib(n-2, memo);
+  long long res = memo_Fib(n-1, memo) + memo_Fib(n-2, memo);
   // cache before returning
   memo[n-1] = res;
   return res; 
@@ -37,9 +38,9 @@ int memo_Fib(int n, vector<int>& memo) {
 
 // Bottom-up, tabulation
 // O(n) time, O(n) space.
-int memo_Fib2(int n) {
+long long memo_Fib2(int n) {
   if (n <= 2) return 1;
-  vector<int> memo(n);
+  vector<long long> memo(n);
   memo[0] = 1;
   memo[1] = 1;
   for (int i = 2; i < n; i++) memo[i] = memo[i-1] + memo[i-2];
@@ -48,14 +49,15 @@ int memo_Fib2(int n) {
 
 // Optimal solution, bottom up DP
 // O(n) time, O(1) space
-int optimal_Fib(int n) {
+// (optimal for a loop, see fast_Fib below for O(log n))
+long long optimal_Fib(int n) {
   // stores n - 2
-  int two_back = 1;
+  long long two_back = 1;
   // stores n
-  int one_back = 1;
+  long long one_back = 1;
   for (int i = 3; i <= n; i++) {
     // calculates n
-    int tmp = one_back + two_back;
+    long long tmp = one_back + two_back;
     two_back = one_back;
     // n will always be stores in one_back
     one_back = tmp;
@@ -63,6 +65,537 @@ int optimal_Fib(int n) {
   return one_back;
 }
 
+/*
+  O(log n) Fibonacci and general linear recurrences
+  Fast doubling: from F(k-1), F(k) we can jump straight to k * 2
+    F(2k - 1) = F(k - 1)^2 + F(k)^2
+    F(2k)     = F(k) * (2 F(k - 1) + F(k))
+  Walk the bits of n from the top, double each step, and add one more
+  (F(k), F(k + 1)) = (F(k), F(k - 1) + F(k)) when the bit is set.
+  O(log n) multiplications, and it only needs + and *, so the same code
+  works for any number type T:
+    uint64_t / unsigned __int128 -> exact while it fits (n <= 93 / 186),
+                                    past that it's the answer mod 2^64 / 2^128
+                                    which is often what hashing code wants
+    ModInt<MOD>                  -> answer mod a prime (or any modulus)
+    BigInt                       -> exact, any size (digits grow with n)
+  Everything except BigInt is constexpr so it can build tables at compile time.
+*/
+
+// number mod MOD, MOD up to 2^63 (multiplies go through 128 bit)
+template <uint64_t MOD>
+struct ModInt {
+  uint64_t val;
+  constexpr ModInt(uint64_t v = 0): val(v % MOD) {}
+  constexpr ModInt operator+(ModInt o) const {
+    uint64_t sum = val + o.val;
+    return ModInt(sum >= MOD ? sum - MOD : sum);
+  }
+  constexpr ModInt operator*(ModInt o) const {
+    return ModInt((uint64_t)((unsigned __int128)val * o.val % MOD));
+  }
+  constexpr bool operator==(ModInt o) const { return val == o.val; }
+};
+
+// Non negative arbitrary precision int, base 10^9 digits, least significant first.
+// Schoolbook multiply, fine for results up to a few hundred thousand digits
+class BigInt {
+private:
+  static const uint32_t BASE = 1000000000;
+  vector<uint32_t> digits;
+
+  void trim() {
+    while (digits.size() > 1 && digits.back() == 0) digits.pop_back();
+  }
+
+public:
+  BigInt(uint64_t v = 0) {
+    do {
+      digits.push_back(v % BASE);
+      v /= BASE;
+    } while (v > 0);
+  }
+
+  BigInt operator+(const BigInt& o) const {
+    BigInt res;
+    res.digits.assign(max(digits.size(), o.digits.size()) + 1, 0);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < res.digits.size(); i++) {
+      uint64_t sum = carry;
+      if (i < digits.size()) sum += digits[i];
+      if (i < o.digits.size()) sum += o.digits[i];
+      res.digits[i] = sum % BASE;
+      carry = sum / BASE;
+    }
+    res.trim();
+    return res;
+  }
+
+  BigInt operator*(const BigInt& o) const {
+    vector<uint64_t> acc(digits.size() + o.digits.size() + 1, 0);
+    for (size_t i = 0; i < digits.size(); i++) {
+      uint64_t carry = 0;
+      for (size_t j = 0; j < o.digits.size(); j++) {
+        uint64_t cur = acc[i + j] + (uint64_t)digits[i] * o.digits[j] + carry;
+        acc[i + j] = cur % BASE;
+        carry = cur / BASE;
+      }
+      for (size_t k = i + o.digits.size(); carry > 0; k++) {
+        uint64_t cur = acc[k] + carry;
+        acc[k] = cur % BASE;
+        carry = cur / BASE;
+      }
+    }
+    BigInt res;
+    res.digits.assign(acc.begin(), acc.end());
+    res.trim();
+    return res;
+  }
+
+  bool operator==(const BigInt& o) const { return digits == o.digits; }
+
+  string to_string() const {
+    string res = std::to_string(digits.back());
+    for (int i = (int)digits.size() - 2; i >= 0; i--) {
+      string part = std::to_string(digits[i]);
+      res += string(9 - part.size(), '0') + part;
+    }
+    return res;
+  }
+};
+
+// nth Fibonacci, F(0) = 0, F(1) = 1. O(log n)
+template <typename T>
+constexpr T fast_Fib(uint64_t n) {
+  // (F(k - 1), F(k)) starting at k = 0, F(-1) = 1
+  T prev = T(1), curr = T(0);
+  for (int bit = 63; bit >= 0; bit--) {
+    T two_prev = prev + prev;
+    T next_prev = prev * prev + curr * curr;
+    T next_curr = curr * (two_prev + curr);
+    prev = next_prev;
+    curr = next_curr;
+    if ((n >> bit) & 1) {
+      T sum = prev + curr;
+      prev = curr;
+      curr = sum;
+    }
+  }
+  return curr;
+}
+
+// Compile time table, ie constexpr auto FIB = fibTable<uint64_t, 94>();
+// gives every Fibonacci number that fits in 64 bits for free at runtime
+template <typename T, size_t N>
+constexpr array<T, N> fibTable() {
+  array<T, N> table{};
+  if (N > 1) table[1] = T(1);
+  for (size_t i = 2; i < N; i++) table[i] = table[i - 1] + table[i - 2];
+  return table;
+}
+
+/*
+  Any linear recurrence a(n) = c[0] a(n - 1) + c[1] a(n - 2) + ... + c[K - 1] a(n - K)
+  Keep the state (a(n), a(n + 1), ..., a(n + K - 1)) as a vector. One step is
+  a K x K matrix M: shift everything up by one, and the last row holds c.
+  So state(n) = M^n state(0), and M^n by repeated squaring is O(K^3 log n).
+  Fib is K = 2, c = {1, 1}, init = {0, 1}.
+*/
+template <typename T, size_t K>
+using Matrix = array<array<T, K>, K>;
+
+template <typename T, size_t K>
+constexpr Matrix<T, K> mat_mul(const Matrix<T, K>& a, const Matrix<T, K>& b) {
+  Matrix<T, K> res{};
+  for (size_t i = 0; i < K; i++) {
+    for (size_t j = 0; j < K; j++) res[i][j] = T(0);
+    // i-k-j order so the inner loop walks rows of b and res
+    for (size_t k = 0; k < K; k++) {
+      for (size_t j = 0; j < K; j++) res[i][j] = res[i][j] + a[i][k] * b[k][j];
+    }
+  }
+  return res;
+}
+
+template <typename T, size_t K>
+constexpr array<T, K> mat_vec(const Matrix<T, K>& m, const array<T, K>& v) {
+  array<T, K> res{};
+  for (size_t i = 0; i < K; i++) {
+    res[i] = T(0);
+    for (size_t j = 0; j < K; j++) res[i] = res[i] + m[i][j] * v[j];
+  }
+  return res;
+}
+
+template <typename T, size_t K>
+constexpr Matrix<T, K> companion(const array<T, K>& c) {
+  Matrix<T, K> m{};
+  for (size_t i = 0; i < K; i++) {
+    for (size_t j = 0; j < K; j++) m[i][j] = T(0);
+  }
+  for (size_t i = 0; i + 1 < K; i++) m[i][i + 1] = T(1);
+  // a(n + K) = c[0] a(n + K - 1) + ... + c[K - 1] a(n)
+  for (size_t j = 0; j < K; j++) m[K - 1][j] = c[K - 1 - j];
+  return m;
+}
+
+// c = coefficients, init = a(0) .. a(K - 1)
+template <typename T, size_t K>
+constexpr T linearRecurrence(const array<T, K>& c, const array<T, K>& init, uint64_t n) {
+  Matrix<T, K> power = companion(c);
+  array<T, K> state = init;
+  // powers of M commute, so applying M^(2^i) for each set bit in any order works
+  while (n > 0) {
+    if (n & 1) state = mat_vec(power, state);
+    n >>= 1;
+    if (n > 0) power = mat_mul(power, power);
+  }
+  return state[0];
+}
+
+/*
+  Batched queries: every query needs the same M^(2^i), so square once,
+  keep all 64 of them, then each query is just matrix-vector products:
+  O(K^3 log max_n) once + O(K^2 log n) per query instead of O(K^3 log n)
+*/
+template <typename T, size_t K>
+vector<T> linearRecurrenceBatch(const array<T, K>& c, const array<T, K>& init, const vector<uint64_t>& ns) {
+  uint64_t max_n = 0;
+  for (uint64_t n: ns) max_n = max(max_n, n);
+  vector<Matrix<T, K>> powers = {companion(c)};
+  while (powers.size() < 64 && (max_n >> powers.size()) > 0) powers.push_back(mat_mul(powers.back(), powers.back()));
+  vector<T> res;
+  res.reserve(ns.size());
+  for (uint64_t n: ns) {
+    array<T, K> state = init;
+    // shift a copy down instead of n >> bit, bit would hit 64 (UB) when bit 63 is set
+    for (size_t bit = 0; n > 0; bit++, n >>= 1) {
+      if (n & 1) state = mat_vec(powers[bit], state);
+    }
+    res.push_back(state[0]);
+  }
+  return res;
+}
+
+// Batch answers have to match fast doubling, including n with the top bit set
+bool checkLinearRecurrenceBatch() {
+  using M = ModInt<1000000007>;
+  vector<uint64_t> ns = {0, 1, 2, 93, 1000000000000ULL, (1ULL << 63) + 5, numeric_limits<uint64_t>::max()};
+  vector<M> batch = linearRecurrenceBatch<M, 2>({1, 1}, {0, 1}, ns);
+  for (size_t i = 0; i < ns.size(); i++) {
+    if (!(batch[i] == fast_Fib<M>(ns[i]))) return false;
+  }
+  return true;
+}
+
+// compile time checks, these cost nothing at runtime
+static_assert(fast_Fib<uint64_t>(93) == 12200160415121876738ULL, "F(93) is the largest that fits in 64 bits");
+static_assert(fibTable<uint64_t, 94>()[93] == fast_Fib<uint64_t>(93), "table and fast doubling agree");
+static_assert(linearRecurrence<uint64_t, 2>({1, 1}, {0, 1}, 90) == fast_Fib<uint64_t>(90), "matrix and fast doubling agree");
+static_assert(fast_Fib<ModInt<1000000007>>(1000000000000ULL) == linearRecurrence<ModInt<1000000007>, 2>({1, 1}, {0, 1}, 1000000000000ULL), "mod versions agree");
+static_assert(fast_Fib<ModInt<1000000007>>((1ULL << 63) + 5) == linearRecurrence<ModInt<1000000007>, 2>({1, 1}, {0, 1}, (1ULL << 63) + 5), "top bit of n works");
+
+/*
+  Generic memoization
+  Same idea as memo_Fib but reusable: write the recursion once as a lambda
+  that takes "self" as first argument and calls self(...) instead of
+  itself, and memoize() wraps it with a cache. ie
+    auto fib = memoize<long long(int)>([](auto& self, int n) -> long long {
+      if (n <= 2) return n == 0 ? 0 : 1;
+      return self(n - 1) + self(n - 2);
+    });
+    fib(80);
+  Where the results live (the store) is picked from the key type:
+    one int-sized (or smaller) integer arg -> DenseStore, a growing vector
+                    indexed by the key, keys past 2^20 spill into a map
+    anything else   -> HashStore, unordered_map (several args become a tuple key,
+                    and 64 bit keys are usually sparse like n / 2, n / 3)
+  or ask for one explicitly:
+    memoize_dense -> DenseStore with your own bound on the array part
+    memoize_lru   -> LRUStore, keeps only the most recent capacity results
+    memoize_shared -> ShardedStore, safe to call from many threads at once
+  Every wrapper counts hits and misses so you can see if the cache helps.
+*/
+
+// hash for tuple keys (multi argument functions), std::hash has none
+struct KeyHash {
+  template <typename T>
+  size_t operator()(const T& key) const {
+    return hash<T>()(key);
+  }
+
+  template <typename... Ts>
+  size_t operator()(const tuple<Ts...>& key) const {
+    size_t seed = 0;
+    apply([&](const Ts&... parts) {
+      // boost hash_combine
+      ((seed ^= KeyHash()(parts) + 0x9e3779b97f7f4a15ULL + (seed << 6) + (seed >> 2)), ...);
+    }, key);
+    return seed;
+  }
+};
+
+// Vector indexed by key for keys in [0, bound), grows as needed up to bound.
+// Anything else (negative, or too big to be worth an array slot per value)
+// goes in a side map, so a sparse key like n / 2, n / 3 can't blow up memory
+template <typename Key, typename Value>
+class DenseStore {
+private:
+  size_t bound;
+  vector<Value> vals;
+  vector<bool> has;
+  unordered_map<Key, Value> sparse;
+
+  bool in_range(const Key& key) const {
+    if constexpr (is_signed_v<Key>) {
+      if (key < 0) return false;
+    }
+    return (uint64_t)key < bound;
+  }
+
+public:
+  DenseStore(size_t bound = 1 << 20): bound(bound) {}
+
+  bool lookup(const Key& key, Value& out) {
+    if (!in_range(key)) {
+      auto it = sparse.find(key);
+      if (it == sparse.end()) return false;
+      out = it->second;
+      return true;
+    }
+    if ((size_t)key >= has.size() || !has[key]) return false;
+    out = vals[key];
+    return true;
+  }
+
+  void insert(const Key& key, const Value& val) {
+    if (!in_range(key)) {
+      sparse[key] = val;
+      return;
+    }
+    if ((size_t)key >= has.size()) {
+      // double so n inserts in increasing order are O(n) total
+      size_t size = min(bound, max((size_t)key + 1, 2 * has.size()));
+      vals.resize(size);
+      has.resize(size, false);
+    }
+    vals[key] = val;
+    has[key] = true;
+  }
+};
+
+template <typename Key, typename Value>
+class HashStore {
+private:
+  unordered_map<Key, Value, KeyHash> map;
+
+public:
+  bool lookup(const Key& key, Value& out) {
+    auto it = map.find(key);
+    if (it == map.end()) return false;
+    out = it->second;
+    return true;
+  }
+
+  void insert(const Key& key, const Value& val) {
+    map[key] = val;
+  }
+};
+
+// Bounded: list in most recently used order, map from key to list node.
+// When full, drop the back of the list (least recently used)
+template <typename Key, typename Value>
+class LRUStore {
+private:
+  size_t capacity;
+  list<pair<Key, Value>> items;
+  unordered_map<Key, typename list<pair<Key, Value>>::iterator, KeyHash> map;
+
+public:
+  LRUStore(size_t capacity = 1024): capacity(max<size_t>(capacity, 1)) {}
+
+  bool lookup(const Key& key, Value& out) {
+    auto it = map.find(key);
+    if (it == map.end()) return false;
+    // move to front, splice doesn't invalidate the iterator
+    items.splice(items.begin(), items, it->second);
+    out = it->second->second;
+    return true;
+  }
+
+  void insert(const Key& key, const Value& val) {
+    auto it = map.find(key);
+    if (it != map.end()) {
+      it->second->second = val;
+      items.splice(items.begin(), items, it->second);
+      return;
+    }
+    if (items.size() == capacity) {
+      map.erase(items.back().first);
+      items.pop_back();
+    }
+    items.push_front({key, val});
+    map[key] = items.begin();
+  }
+};
+
+// Thread safe: keys are split over shards by hash, each with its own lock,
+// so threads working on different subproblems rarely wait on each other.
+// The lock is never held while computing, two threads may both compute the
+// same missing value, that's fine since they get the same answer
+template <typename Key, typename Value>
+class ShardedStore {
+private:
+  struct Shard {
+    mutex m;
+    unordered_map<Key, Value, KeyHash> map;
+  };
+  static const int NUM_SHARDS = 64;
+  unique_ptr<Shard[]> shards;
+
+  Shard& shard_of(const Key& key) {
+    return shards[KeyHash()(key) % NUM_SHARDS];
+  }
+
+public:
+  ShardedStore(): shards(new Shard[NUM_SHARDS]) {}
+
+  bool lookup(const Key& key, Value& out) {
+    Shard& s = shard_of(key);
+    lock_guard<mutex> lock(s.m);
+    auto it = s.map.find(key);
+    if (it == s.map.end()) return false;
+    out = it->second;
+    return true;
+  }
+
+  void insert(const Key& key, const Value& val) {
+    Shard& s = shard_of(key);
+    lock_guard<mutex> lock(s.m);
+    s.map.emplace(key, val);
+  }
+};
+
+// one arg -> that type, more -> tuple of them
+template <typename... Args>
+struct memo_key {
+  using type = tuple<decay_t<Args>...>;
+};
+
+template <typename Arg>
+struct memo_key<Arg> {
+  using type = decay_t<Arg>;
+};
+
+template <typename Key, typename Value>
+using default_store = conditional_t<is_integral_v<Key> && sizeof(Key) <= sizeof(int), DenseStore<Key, Value>, HashStore<Key, Value>>;
+
+template <typename Store, typename Sig>
+class Memoized;
+
+template <typename Store, typename R, typename... Args>
+class Memoized<Store, R(Args...)> {
+private:
+  using Key = typename memo_key<Args...>::type;
+  function<R(Memoized&, Args...)> f;
+  Store store;
+  atomic<uint64_t> hits{0};
+  atomic<uint64_t> misses{0};
+
+public:
+  template <typename F>
+  Memoized(F fn, Store s = Store()): f(move(fn)), store(move(s)) {}
+
+  R operator()(Args... args) {
+    Key key{args...};
+    R res;
+    if (store.lookup(key, res)) {
+      hits.fetch_add(1, memory_order_relaxed);
+      return res;
+    }
+    misses.fetch_add(1, memory_order_relaxed);
+    res = f(*this, args...);
+    store.insert(key, res);
+    return res;
+  }
+
+  uint64_t hitCount() const { return hits.load(); }
+  uint64_t missCount() const { return misses.load(); }
+};
+
+template <typename Sig>
+struct memo_sig;
+
+template <typename R, typename... Args>
+struct memo_sig<R(Args...)> {
+  using Key = typename memo_key<Args...>::type;
+  using Value = R;
+};
+
+template <typename Sig, typename F>
+Memoized<default_store<typename memo_sig<Sig>::Key, typename memo_sig<Sig>::Value>, Sig> memoize(F f) {
+  return {move(f)};
+}
+
+// keys in [0, bound) go in the array, for when you know the index range
+template <typename Sig, typename F>
+Memoized<DenseStore<typename memo_sig<Sig>::Key, typename memo_sig<Sig>::Value>, Sig> memoize_dense(size_t bound, F f) {
+  return {move(f), DenseStore<typename memo_sig<Sig>::Key, typename memo_sig<Sig>::Value>(bound)};
+}
+
+template <typename Sig, typename F>
+Memoized<LRUStore<typename memo_sig<Sig>::Key, typename memo_sig<Sig>::Value>, Sig> memoize_lru(size_t capacity, F f) {
+  return {move(f), LRUStore<typename memo_sig<Sig>::Key, typename memo_sig<Sig>::Value>(capacity)};
+}
+
+template <typename Sig, typename F>
+Memoized<ShardedStore<typename memo_sig<Sig>::Key, typename memo_sig<Sig>::Value>, Sig> memoize_shared(F f) {
+  return {move(f)};
+}
+
+/*
+  Top down -> bottom up, automatically
+  For DP indexed by one int where f(i) only needs smaller indices we can
+  take the exact same self-lambda and just fill a table for i = 0..n in
+  order. Every self(j) is then a plain array read, no recursion so no
+  stack overflow for big n. If f does ask for something not filled yet
+  it still works, it just recurses to compute it like the memoized version.
+  Indices outside [0, n] aren't in the table, those get memoized in a side
+  map instead (and aren't returned).
+*/
+template <typename R, typename F>
+vector<R> tabulate(int n, F f) {
+  vector<R> table(n + 1);
+  vector<bool> done(n + 1, false);
+  unordered_map<int, R> outside;
+  function<R(int)> self = [&](int i) -> R {
+    if (i < 0 || i > n) {
+      auto it = outside.find(i);
+      if (it != outside.end()) return it->second;
+      R res = f(self, i);
+      outside[i] = res;
+      return res;
+    }
+    if (done[i]) return table[i];
+    R res = f(self, i);
+    table[i] = res;
+    done[i] = true;
+    return res;
+  };
+  for (int i = 0; i <= n; i++) self(i);
+  return table;
+}
+
+// Fib using the framework, same lambda works for both
+long long generic_Fib(int n) {
+  auto fib = [](auto& self, int i) -> long long {
+    if (i <= 2) return i == 0 ? 0 : 1;
+    return self(i - 1) + self(i - 2);
+  };
+  // top down: return memoize<long long(int)>(fib)(n);
+  return tabulate<long long>(n, fib)[n];
+}
+
 /*
   Greedy
   The greedy algorithm is to find the global optimal solution by at each step